@@ -0,0 +1,68 @@
+// host benchmark for the entity store, not part of the game
+// cc -O2 -o entities_bench bench/entities.c -lm && ./entities_bench
+
+#include <stdio.h>
+#include <time.h>
+
+#include "../src/entities.h"
+
+#define FRAMES 1000
+#define DELTATIME 16
+
+static double now_us(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static float random_range(float min, float max) {
+    return min + (max - min) * ((float) rand() / RAND_MAX);
+}
+
+int main(void) {
+    sprite sprites[] = {{3, 0.6}, {7, 0.1}};
+    map m = {NULL, 0, 3, 2};
+    surface surf = surf_create(160, 120);
+    camera cam = {&(point){0, 0}, &(point){0, 0}, &(point){0, 0}, 0.5, 0.25, 0};
+
+    // no walls, every visible entity gets drawn
+    camera_rotate(&cam, 0);
+    camera_render(&cam, &surf, &m, &ray_standard);
+
+    printf("%8s %12s %12s %12s\n", "entities", "update us", "cull us", "render us");
+    for (uint16_t count = 64; count <= 4096; count *= 2) {
+        srand(1);
+        entities ents = entities_create(count);
+        for (uint16_t i = 0; i < count; i++) {
+            entity_spawn(&ents, random_range(-5, 5), random_range(-3, 3),
+                         random_range(-1, 1), random_range(-1, 1), i % 2, 0);
+        }
+
+        double update = 0, cull = 0, render = 0;
+        for (int frame = 0; frame < FRAMES; frame++) {
+            camera_rotate(&cam, frame % 360);
+            double t0 = now_us();
+            entities_update(&ents, DELTATIME);
+            double t1 = now_us();
+            entities_cull(&ents, &cam, &surf, sprites);
+            double t2 = now_us();
+            entities_render(&ents, &cam, &surf, sprites);
+            double t3 = now_us();
+            update += t1 - t0;
+            cull += t2 - t1;
+            render += t3 - t2;
+
+            // keep the population on the map like the game does
+            for (uint16_t i = 0; i < ents.size; i++) {
+                if (ents.x[i] < -5) {ents.x[i] = -5; ents.vx[i] = fabsf(ents.vx[i]);}
+                if (ents.x[i] > 5) {ents.x[i] = 5; ents.vx[i] = -fabsf(ents.vx[i]);}
+                if (ents.y[i] < -3) {ents.y[i] = -3; ents.vy[i] = fabsf(ents.vy[i]);}
+                if (ents.y[i] > 3) {ents.y[i] = 3; ents.vy[i] = -fabsf(ents.vy[i]);}
+            }
+        }
+        printf("%8u %12.2f %12.2f %12.2f\n", count, update / FRAMES, cull / FRAMES, render / FRAMES);
+        entities_destroy(&ents);
+    }
+    surf_destroy(&surf);
+    return 0;
+}
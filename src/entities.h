@@ -0,0 +1,199 @@
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "graphics.h"
+#include "tension.h"
+
+#define ENTITY_CULLED -1.0f
+#define ENTITY_HIDDEN 0b10000000
+
+// TYPES =====================================================================
+
+typedef struct {
+    uint8_t color;
+    float size;
+} sprite;
+
+/// structure of arrays, index i across all arrays is one entity
+typedef struct {
+    float* x;
+    float* y;
+    float* vx;
+    float* vy;
+    uint8_t* sprite;
+    uint8_t* state;
+    float* depth;       // squared distance to the camera, ENTITY_CULLED if not visible
+    uint16_t* order;    // visible entity indices sorted by depth far to near, followed by the culled ones
+    uint16_t visible;   // number of visible entities at the front of order
+    uint16_t size;
+    uint16_t capacity;
+} entities;
+
+// FUNCTIONS =================================================================
+
+static entities entities_create(uint16_t capacity) {
+    return (entities) {
+        malloc(sizeof(float)*capacity),
+        malloc(sizeof(float)*capacity),
+        malloc(sizeof(float)*capacity),
+        malloc(sizeof(float)*capacity),
+        malloc(capacity),
+        malloc(capacity),
+        malloc(sizeof(float)*capacity),
+        malloc(sizeof(uint16_t)*capacity),
+        0, 0, capacity
+    };
+}
+
+static void entities_destroy(entities* e) {
+    free(e->x);
+    free(e->y);
+    free(e->vx);
+    free(e->vy);
+    free(e->sprite);
+    free(e->state);
+    free(e->depth);
+    free(e->order);
+}
+
+/// adds an entity and returns its index, or -1 if the store is full
+static int32_t entity_spawn(entities* e, float x, float y, float vx, float vy, uint8_t sprite, uint8_t state) {
+    if (e->size == e->capacity) return -1;
+    uint16_t i = e->size++;
+    e->x[i] = x;
+    e->y[i] = y;
+    e->vx[i] = vx;
+    e->vy[i] = vy;
+    e->sprite[i] = sprite;
+    e->state[i] = state;
+    e->depth[i] = ENTITY_CULLED;
+    e->order[i] = i;
+    return i;
+}
+
+/// removes an entity by moving the last one into its slot, invalidates the index of the last entity
+static void entity_despawn(entities* e, uint16_t i) {
+    if (i >= e->size) return;
+    uint16_t last = --e->size;
+    if (e->depth[i] != ENTITY_CULLED) e->visible--;
+    e->x[i] = e->x[last];
+    e->y[i] = e->y[last];
+    e->vx[i] = e->vx[last];
+    e->vy[i] = e->vy[last];
+    e->sprite[i] = e->sprite[last];
+    e->state[i] = e->state[last];
+    e->depth[i] = e->depth[last];
+
+    // drop i from the draw order and rename last to i, keeps the order nearly sorted
+    uint16_t k = 0;
+    for (uint16_t j = 0; j <= last; j++) {
+        uint16_t index = e->order[j];
+        if (index == i) continue;
+        e->order[k++] = (index == last) ? i : index;
+    }
+}
+
+/// moves every entity by its velocity, dt in milliseconds and velocity in units per second
+static void entities_update(entities* e, uint32_t dt) {
+    float t = dt * 0.001f;
+    for (uint16_t i = 0; i < e->size; i++) e->x[i] += e->vx[i] * t;
+    for (uint16_t i = 0; i < e->size; i++) e->y[i] += e->vy[i] * t;
+}
+
+/// stores the squared camera distance of every entity between camera.left and camera.right, then sorts far to near
+static void entities_cull(entities* e, camera* c, surface* s, sprite* sprites) {
+    float px = c->p->x;
+    float py = c->p->y;
+    float lx = c->l->x - px;
+    float ly = c->l->y - py;
+    float rx = c->r->x - px;
+    float ry = c->r->y - py;
+    float llen = hypotf(lx, ly);
+    float rlen = hypotf(rx, ry);
+
+    // world units per sprite size to get half the width entities_render draws
+    float scale = 60 * point_length(c->l, c->r) / (s->w * c->w);
+    for (uint16_t i = 0; i < e->size; i++) {
+        float dx = e->x[i] - px;
+        float dy = e->y[i] - py;
+        float radius = sprites[e->sprite[i]].size * scale;
+        bool inside = lx*dy - ly*dx <= radius*llen && rx*dy - ry*dx >= -radius*rlen;
+        e->depth[i] = (inside && !(e->state[i] & ENTITY_HIDDEN)) ? dx*dx + dy*dy : ENTITY_CULLED;
+    }
+
+    // keep the visible entities in the order of the last frame, newly visible ones go last
+    uint16_t n = 0;
+    for (uint16_t j = 0; j < e->size; j++) {
+        uint16_t index = e->order[j];
+        if (e->depth[index] != ENTITY_CULLED) e->order[n++] = index;
+    }
+    e->visible = n;
+    for (uint16_t i = 0; i < e->size; i++) {
+        if (e->depth[i] == ENTITY_CULLED) e->order[n++] = i;
+    }
+
+    // insertion sort of the visible ones only, their order barely changes between frames
+    for (uint16_t j = 1; j < e->visible; j++) {
+        uint16_t index = e->order[j];
+        float depth = e->depth[index];
+        uint16_t k = j;
+        while (k > 0 && e->depth[e->order[k-1]] < depth) {
+            e->order[k] = e->order[k-1];
+            k--;
+        }
+        e->order[k] = index;
+    }
+}
+
+/// draws the visible entities far to near, call after the walls so ray_depth is filled in
+static void entities_render(entities* e, camera* c, surface* s, sprite* sprites) {
+    float px = c->p->x;
+    float py = c->p->y;
+    float lx = c->l->x - px;
+    float ly = c->l->y - py;
+    float rx = c->r->x - px;
+    float ry = c->r->y - py;
+    for (uint16_t j = 0; j < e->visible; j++) {
+        uint16_t i = e->order[j];
+        float len = sqrtf(e->depth[i]);
+        if (len < 0.01f) continue;
+        sprite* current = &sprites[e->sprite[i]];
+
+        // screen column where the ray to the entity crosses the camera plane
+        float dx = e->x[i] - px;
+        float dy = e->y[i] - py;
+        float a = ly*dx - lx*dy;
+        float b = rx*dy - ry*dx;
+        if (a + b <= 0) continue;
+        int center = (int)(s->w * a / (a + b));
+
+        // standing on the floor, like walls with a height of 2
+        int bottom = 60 + (int)(60/len);
+        int height = (int)(current->size*120/len);
+        int top = bottom - height;
+        if (top < 0) top = 0;
+        if (bottom > s->h - 1) bottom = s->h - 1;
+        if (top > bottom) continue;
+        int x0 = center - height/2;
+        int x1 = center + height/2;
+        if (x0 < 0) x0 = 0;
+        if (x1 > s->w - 1) x1 = s->w - 1;
+        for (int x = x0; x <= x1; x++) {
+            if (ray_depth[x] < len) continue;
+            surf_draw_line(s, x, top, x, bottom, current->color);
+        }
+    }
+}
+
+static void entities_render_debug(entities* e, surface* s) {
+    for (uint16_t i = 0; i < e->size; i++) {
+        if (e->state[i] & ENTITY_HIDDEN) continue;
+        surf_set_pixel(s, MTSX(e->x[i], s), MTSY(e->y[i], s), e->depth[i] == ENTITY_CULLED ? 3 : 7);
+    }
+}
+
+#endif //ENTITIES_H
@@ -10,6 +10,7 @@
 #include "strings.h"
 #include "graphics.h"
 #include "tension.h"
+#include "entities.h"
 
 #define ROTATE_COOLDOWN 0
 #define MOVE_COOLDOWN 0
@@ -18,6 +19,10 @@
 #define WALL_COLOR_1 4
 #define WALL_COLOR_2 5
 
+#define MAX_ENTITIES 256
+#define SPRITE_ENEMY 0
+#define SPRITE_PROJECTILE 1
+
 uint8_t start(void) {
 
     // palette
@@ -64,6 +69,18 @@ uint8_t start(void) {
     lines[12] = (line){&points[12], &points[10], WALL_COLOR_2};
     map m = {lines, 13, 3, 2};
 
+    // entities
+    sprite sprites[] = {
+        {3, 0.6}, // enemy
+        {7, 0.1}, // projectile
+    };
+    entities ents = entities_create(MAX_ENTITIES);
+    entity_spawn(&ents, 3, 1.5, 0, 0, SPRITE_ENEMY, 0);
+    entity_spawn(&ents, 3.5, -2, 0, 0, SPRITE_ENEMY, 0);
+    entity_spawn(&ents, -3.5, 2, 0, 0, SPRITE_ENEMY, 0);
+    entity_spawn(&ents, 4, 0, 0, 1, SPRITE_PROJECTILE, 0);
+    entity_spawn(&ents, -4, -2, 1, 0, SPRITE_PROJECTILE, 0);
+
     // init camera
     camera cam = {&(point){0, 0}, &(point){0, 0}, &(point){0, 0}, 0.5, 0.25, 0};
     camera_rotate(&cam, 0);
@@ -123,10 +140,24 @@ uint8_t start(void) {
             }
         } else move_cooldown -= deltatime;
 
+        // entities, projectiles bounce off the border
+        entities_update(&ents, deltatime);
+        for (uint16_t i = 0; i < ents.size; i++) {
+            if (ents.x[i] < -5) {ents.x[i] = -5; ents.vx[i] = fabsf(ents.vx[i]);}
+            if (ents.x[i] > 5) {ents.x[i] = 5; ents.vx[i] = -fabsf(ents.vx[i]);}
+            if (ents.y[i] < -3) {ents.y[i] = -3; ents.vy[i] = fabsf(ents.vy[i]);}
+            if (ents.y[i] > 3) {ents.y[i] = 3; ents.vy[i] = -fabsf(ents.vy[i]);}
+        }
+        entities_cull(&ents, &cam, &surf, sprites);
+
         // render
         camera_render_environment(&cam, &surf, &m);
         camera_render(&cam, &surf, &m, &ray_edges);
-        if (debug) camera_render_debug(&cam, &surf, &m);
+        entities_render(&ents, &cam, &surf, sprites);
+        if (debug) {
+            camera_render_debug(&cam, &surf, &m);
+            entities_render_debug(&ents, &surf);
+        }
 
         // timing
         gpu_block_frame();
@@ -142,6 +173,7 @@ uint8_t start(void) {
         gpu_block_ack();
         gpu_swap_buf();
     }
+    entities_destroy(&ents);
     free(points);
     free(lines);
     return CODE_EXIT;
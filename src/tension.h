@@ -107,6 +107,9 @@ typedef union {
 
 typedef void (*ray)(camera* c, surface* s, map* m, point* p, uint8_t i);
 
+// distance to the closest wall per screen column, written by the ray functions
+static float ray_depth[UINT8_MAX + 1];
+
 // FUNCTIONS =================================================================
 
 void camera_rotate(camera* c, uint16_t a) {
@@ -187,6 +190,7 @@ void ray_standard(camera* c, surface* s, map* m, point* p, uint8_t i) {
             }
         }
     }
+    ray_depth[i] = lowscore;
 }
 
 void ray_edges(camera* c, surface* s, map* m, point* p, uint8_t i) {
@@ -229,6 +233,7 @@ void ray_edges(camera* c, surface* s, map* m, point* p, uint8_t i) {
             }
         }
     }
+    ray_depth[i] = lowscore;
 }
 
 #endif //TENSION_TENSION_H